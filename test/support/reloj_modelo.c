@@ -0,0 +1,189 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Reference model of the clock used to check the optimized implementation
+ **
+ ** \addtogroup clock Clock
+ ** \brief Time and alarm clock management
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "reloj_modelo.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Valor inicial de las variables del modelo
+#define INITIAL_VALUE 0
+
+//! Cantidad de segundos en un minuto
+#define SECONDS_PER_MINUTE 60
+
+//! Cantidad de segundos en una hora
+#define SECONDS_PER_HOUR (60 * SECONDS_PER_MINUTE)
+
+//! Cantidad de segundos en un dia
+#define SECONDS_PER_DAY (24 * SECONDS_PER_HOUR)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Función interna para convertir una hora en formato BCD a segundos desde la medianoche
+ *
+ * @param time Vector con la hora, minutos y segundos en formato BCD
+ *
+ * @return Cantidad de segundos desde la medianoche
+ */
+static uint32_t DigitsToSeconds(uint8_t const time[MODEL_TIME_SIZE]);
+
+/**
+ * @brief Función interna para convertir segundos desde la medianoche a una hora en formato BCD
+ *
+ * @param seconds Cantidad de segundos desde la medianoche
+ * @param time Vector donde se devuelve la hora, minutos y segundos en formato BCD
+ */
+static void SecondsToDigits(uint32_t seconds, uint8_t time[MODEL_TIME_SIZE]);
+
+/**
+ * @brief Función interna equivalente a IncrementTime de la implementación
+ *
+ * @param model Puntero al modelo
+ */
+static void IncrementTime(model_t model);
+
+/**
+ * @brief Función interna equivalente a CheckAlarmTime de la implementación
+ *
+ * @param model Puntero al modelo
+ */
+static void CheckAlarmTime(model_t model);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+uint32_t DigitsToSeconds(uint8_t const time[MODEL_TIME_SIZE]) {
+    uint32_t hours = 10 * time[0] + time[1];
+    uint32_t minutes = 10 * time[2] + time[3];
+    uint32_t seconds = 10 * time[4] + time[5];
+
+    return hours * SECONDS_PER_HOUR + minutes * SECONDS_PER_MINUTE + seconds;
+}
+
+void SecondsToDigits(uint32_t seconds, uint8_t time[MODEL_TIME_SIZE]) {
+    uint32_t hours = seconds / SECONDS_PER_HOUR;
+    uint32_t minutes = (seconds % SECONDS_PER_HOUR) / SECONDS_PER_MINUTE;
+
+    seconds = seconds % SECONDS_PER_MINUTE;
+    time[0] = hours / 10;
+    time[1] = hours % 10;
+    time[2] = minutes / 10;
+    time[3] = minutes % 10;
+    time[4] = seconds / 10;
+    time[5] = seconds % 10;
+}
+
+void IncrementTime(model_t model) {
+    model->seconds = (model->seconds + 1) % SECONDS_PER_DAY;
+}
+
+void CheckAlarmTime(model_t model) {
+    uint8_t time[MODEL_TIME_SIZE];
+
+    SecondsToDigits(model->seconds, time);
+    if (model->enabled && (memcmp(time, model->alarm, MODEL_TIME_SIZE) == 0)) {
+        model->events++;
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void ModelCreate(model_t model, uint16_t ticks_per_second) {
+    memset(model, INITIAL_VALUE, sizeof(struct model_s));
+    model->ticks_per_second = ticks_per_second;
+}
+
+bool ModelGetTime(model_t model, uint8_t * time, uint8_t size) {
+    uint8_t current[MODEL_TIME_SIZE];
+
+    SecondsToDigits(model->seconds, current);
+    memcpy(time, current, size);
+    return model->valid;
+}
+
+void ModelSetupTime(model_t model, uint8_t const * const time, uint8_t size) {
+    uint8_t digits[MODEL_TIME_SIZE] = {INITIAL_VALUE};
+
+    memcpy(digits, time, size);
+    model->seconds = DigitsToSeconds(digits);
+    model->valid = true;
+}
+
+void ModelNewTick(model_t model) {
+    model->ticks_count++;
+    if (model->ticks_count == model->ticks_per_second) {
+        model->ticks_count = INITIAL_VALUE;
+        IncrementTime(model);
+        CheckAlarmTime(model);
+    }
+}
+
+void ModelSetupAlarm(model_t model, uint8_t const * const time, uint8_t size) {
+    // Igual que ClockSetupAlarm, los digitos que no se informan conservan el valor anterior
+    memcpy(model->alarm, time, size);
+    model->enabled = true;
+}
+
+bool ModelGetAlarm(model_t model, uint8_t * time, uint8_t size) {
+    if ((time != NULL) && (size > 0)) {
+        memcpy(time, model->alarm, size);
+    }
+    return model->enabled;
+}
+
+bool ModelToggleAlarm(model_t model) {
+    model->enabled = !model->enabled;
+    return model->enabled;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,157 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RELOJ_MODELO_H
+#define RELOJ_MODELO_H
+
+/** \brief Declarations for the reference model of the clock
+ **
+ ** \addtogroup clock Clock
+ ** \brief Time and alarm clock management
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de elementos en el arreglo BCD con la hora del modelo
+#define MODEL_TIME_SIZE 6
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Modelo de referencia del reloj
+ *
+ * Mantiene la hora como segundos transcurridos desde la medianoche, en lugar de digitos BCD, para
+ * que su comportamiento no dependa de la implementacion que se quiere verificar.
+ */
+typedef struct model_s {
+    uint32_t seconds;
+    uint8_t alarm[MODEL_TIME_SIZE];
+    uint16_t ticks_count;
+    uint16_t ticks_per_second;
+    bool valid;
+    bool enabled;
+    uint32_t events;
+} * model_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Función para iniciar el modelo con el mismo estado que ClockCreate
+ *
+ * @param model Puntero al modelo que se inicializa
+ * @param ticks_per_second Cantidad de pulsos que debe recibir para contar un segundo
+ */
+void ModelCreate(model_t model, uint16_t ticks_per_second);
+
+/**
+ * @brief Funcion para obtener la hora actual del modelo en el mismo formato que ClockGetTime
+ *
+ * @param model Puntero al modelo
+ * @param time Vector donde se devuelve la hora, minutos y segundos en formato BCD
+ * @param size Cantidad de elementos disponibles en el vector de resultado
+ *
+ * @return true La hora es válida
+ * @return false El modelo no fué ajustado y por lo tanto la hora no es válida
+ */
+bool ModelGetTime(model_t model, uint8_t * time, uint8_t size);
+
+/**
+ * @brief Función para poner en hora el modelo
+ *
+ * @param model Puntero al modelo
+ * @param time Vector que contiene la hora, minutos y segundos a configurar en formato BCD
+ * @param size Cantidad de elementos en el vector con la hora a configurar
+ */
+void ModelSetupTime(model_t model, uint8_t const * const time, uint8_t size);
+
+/**
+ * @brief Función para contar un nuevo tick en el modelo
+ *
+ * @param model Puntero al modelo
+ */
+void ModelNewTick(model_t model);
+
+/**
+ * @brief Función para fijar la hora de la alarma del modelo
+ *
+ * @param model Puntero al modelo
+ * @param time Vector que contiene la hora, minutos y segundos a configurar en formato BCD
+ * @param size Cantidad de elementos en el vector con la hora a configurar
+ */
+void ModelSetupAlarm(model_t model, uint8_t const * const time, uint8_t size);
+
+/**
+ * @brief Funcion para obtener la hora y el estado de la alarma del modelo
+ *
+ * @param model Puntero al modelo
+ * @param time Vector donde se devuelve la hora, minutos y segundos en formato BCD
+ * @param size Cantidad de elementos disponibles en el vector de resultado
+ *
+ * @return true La alarma se encuentra activada
+ * @return false La alarma se encuentra deshabilitada
+ */
+bool ModelGetAlarm(model_t model, uint8_t * time, uint8_t size);
+
+/**
+ * @brief Función para habilitar o deshabilitar la alarma del modelo
+ *
+ * @param model Puntero al modelo
+ *
+ * @return true La alarma se encuentra activada
+ * @return false La alarma se encuentra deshabilitada
+ */
+bool ModelToggleAlarm(model_t model);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* RELOJ_MODELO_H */
@@ -0,0 +1,228 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Randomized equivalence test between the clock and its reference model
+ **
+ ** \addtogroup clock Clock
+ ** \brief Time and alarm clock management
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "cronometro.h"
+#include "reloj.h"
+#include "reloj_modelo.h"
+#include "unity.h"
+#include <stdio.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Cantidad de ticks por segundo con la que se inician las pruebas
+#define TICKS_PER_SECOND 5
+
+//! Maxima cantidad de ticks por segundo utilizada al cambiar la frecuencia
+#define MAX_TICKS_PER_SECOND 10
+
+//! Semilla del generador pseudoaleatorio, fija para que una falla sea reproducible
+#define SEMILLA 0x5A5E2024u
+
+//! Cantidad de operaciones aleatorias aplicadas al reloj y al modelo
+#define OPERACIONES 20000
+
+//! Cantidad de ticks utilizados para medir el rendimiento
+#define TICKS_RENDIMIENTO 2000000
+
+//! Cantidad de segundos en un dia
+#define SEGUNDOS_POR_DIA 86400
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static clock_t reloj;
+
+static struct model_s modelo[1];
+
+static uint32_t eventos;
+
+static uint32_t disparos;
+
+static uint32_t semilla;
+
+static char mensaje[64];
+
+/* === Private function implementation ========================================================= */
+
+void EventoAlarma(clock_t reloj) {
+    eventos++;
+    disparos++;
+}
+
+uint32_t Aleatorio(uint32_t limite) {
+    semilla ^= semilla << 13;
+    semilla ^= semilla >> 17;
+    semilla ^= semilla << 5;
+    return semilla % limite;
+}
+
+void ConvertirHora(uint32_t segundos, uint8_t hora[MODEL_TIME_SIZE]) {
+    static const uint32_t PESOS[] = {36000, 3600, 600, 60, 10, 1};
+
+    for (int indice = 0; indice < MODEL_TIME_SIZE; indice++) {
+        hora[indice] = segundos / PESOS[indice];
+        segundos = segundos % PESOS[indice];
+    }
+}
+
+uint32_t SegundosAleatorios(void) {
+    static const uint32_t LIMITES[] = {60, 3600, SEGUNDOS_POR_DIA};
+    uint32_t segundos = Aleatorio(SEGUNDOS_POR_DIA);
+
+    // La mitad de las veces se elige una hora a pocos segundos de un cambio de minuto, hora o dia
+    if (Aleatorio(2)) {
+        uint32_t limite = LIMITES[Aleatorio(3)];
+        segundos = segundos - segundos % limite + limite - 1 - Aleatorio(3);
+    }
+    return segundos % SEGUNDOS_POR_DIA;
+}
+
+void CompararEstado(uint32_t paso) {
+    uint8_t esperado[MODEL_TIME_SIZE];
+    uint8_t obtenido[MODEL_TIME_SIZE];
+
+    snprintf(mensaje, sizeof(mensaje), "Paso %lu, semilla 0x%08lX", (unsigned long)paso, (unsigned long)SEMILLA);
+
+    TEST_ASSERT_EQUAL_MESSAGE(ModelGetTime(modelo, esperado, sizeof(esperado)),
+                              ClockGetTime(reloj, obtenido, sizeof(obtenido)), mensaje);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(esperado, obtenido, sizeof(esperado), mensaje);
+
+    TEST_ASSERT_EQUAL_MESSAGE(ModelGetAlarm(modelo, esperado, sizeof(esperado)),
+                              ClockGetAlarm(reloj, obtenido, sizeof(obtenido)), mensaje);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(esperado, obtenido, sizeof(esperado), mensaje);
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(modelo->events, eventos, mensaje);
+}
+
+void CrearAmbos(uint16_t ticks_per_second) {
+    eventos = 0;
+    reloj = ClockCreate(ticks_per_second, EventoAlarma);
+    ModelCreate(modelo, ticks_per_second);
+}
+
+void SimularTicks(uint32_t cantidad, uint32_t paso) {
+    for (uint32_t contador = 0; contador < cantidad; contador++) {
+        ClockNewTick(reloj);
+        ModelNewTick(modelo);
+        CompararEstado(paso);
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    semilla = SEMILLA;
+    disparos = 0;
+    CrearAmbos(TICKS_PER_SECOND);
+}
+
+void test_random_operations_match_model(void) {
+    uint8_t hora[MODEL_TIME_SIZE];
+    uint8_t tamanio;
+    uint32_t segundos;
+
+    for (uint32_t paso = 0; paso < OPERACIONES; paso++) {
+        uint32_t operacion = Aleatorio(100);
+
+        if (operacion < 70) {
+            SimularTicks(1 + Aleatorio(4 * MAX_TICKS_PER_SECOND), paso);
+        } else if (operacion < 80) {
+            ConvertirHora(SegundosAleatorios(), hora);
+            tamanio = Aleatorio(2) ? MODEL_TIME_SIZE : 4;
+            ClockSetupTime(reloj, hora, tamanio);
+            ModelSetupTime(modelo, hora, tamanio);
+        } else if (operacion < 90) {
+            // La mitad de las alarmas se fija unos segundos despues de la hora actual para que se disparen
+            segundos = Aleatorio(2) ? modelo->seconds + 1 + Aleatorio(3) : SegundosAleatorios();
+            ConvertirHora(segundos % SEGUNDOS_POR_DIA, hora);
+            tamanio = Aleatorio(2) ? MODEL_TIME_SIZE : 4;
+            ClockSetupAlarm(reloj, hora, tamanio);
+            ModelSetupAlarm(modelo, hora, tamanio);
+        } else if (operacion < 97) {
+            TEST_ASSERT_EQUAL(ModelToggleAlarm(modelo), ClockToggleAlarm(reloj));
+        } else {
+            CrearAmbos(1 + Aleatorio(MAX_TICKS_PER_SECOND));
+        }
+        CompararEstado(paso);
+    }
+    TEST_ASSERT_NOT_EQUAL(0, disparos);
+}
+
+void test_throughput_against_model(void) {
+    static const uint8_t INICIAL[] = {2, 3, 5, 9, 5, 0};
+    static const uint8_t ALARMA[] = {0, 0, 0, 0, 0, 0};
+    double inicio, reloj_segundos, modelo_segundos;
+
+    // Con un tick por segundo cada llamada incrementa la hora y verifica la alarma
+    CrearAmbos(1);
+    ClockSetupTime(reloj, INICIAL, sizeof(INICIAL));
+    ModelSetupTime(modelo, INICIAL, sizeof(INICIAL));
+    ClockSetupAlarm(reloj, ALARMA, sizeof(ALARMA));
+    ModelSetupAlarm(modelo, ALARMA, sizeof(ALARMA));
+
+    inicio = CronometroSegundos();
+    for (uint32_t contador = 0; contador < TICKS_RENDIMIENTO; contador++) {
+        ClockNewTick(reloj);
+    }
+    reloj_segundos = CronometroSegundos() - inicio;
+
+    inicio = CronometroSegundos();
+    for (uint32_t contador = 0; contador < TICKS_RENDIMIENTO; contador++) {
+        ModelNewTick(modelo);
+    }
+    modelo_segundos = CronometroSegundos() - inicio;
+
+    printf("Reloj: %.0f ticks/s, modelo: %.0f ticks/s\n", TICKS_RENDIMIENTO / (reloj_segundos + 1e-9),
+           TICKS_RENDIMIENTO / (modelo_segundos + 1e-9));
+    CompararEstado(TICKS_RENDIMIENTO);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */